@@ -19,7 +19,68 @@
 
 #include "rng90.h"
 
-unsigned char rng90_buffer[87];
+#if (RNG90_BUFFER_SIZE < RNG90_OPERATION_RANDOM_RNG_SIZE) || (RNG90_BUFFER_SIZE > 255)
+	#error "RNG90_BUFFER_SIZE must hold RNG90_OPERATION_RANDOM_RNG_SIZE bytes and must not exceed 255"
+#endif
+
+#if ((RNG90_QUEUE_SIZE & (RNG90_QUEUE_SIZE - 1)) != 0) || (RNG90_QUEUE_SIZE < 2) || (RNG90_QUEUE_SIZE > 256)
+	#error "RNG90_QUEUE_SIZE must be a power of two between 2 and 256"
+#endif
+
+#if RNG90_REPEAT_DETECTION_BLOCKS > 65535
+	#error "RNG90_REPEAT_DETECTION_BLOCKS must not exceed 65535"
+#endif
+
+#if RNG90_HAL_RUNTIME
+	static const RNG90_HAL *rng90_hal_current;
+	
+	#define RNG90_TWI_START()         rng90_hal_current->start()
+	#define RNG90_TWI_ADDRESS(a, o)   rng90_hal_current->address((a), (o))
+	#define RNG90_TWI_SET(d)          rng90_hal_current->set(d)
+	#define RNG90_TWI_GET(d, a)       rng90_hal_current->get((d), (a))
+	#define RNG90_TWI_STOP()          rng90_hal_current->stop()
+#else
+	#define RNG90_TWI_START()         twi_start()
+	#define RNG90_TWI_ADDRESS(a, o)   twi_address((a), (o))
+	#define RNG90_TWI_SET(d)          twi_set(d)
+	#define RNG90_TWI_GET(d, a)       twi_get((d), (a))
+	#define RNG90_TWI_STOP()          twi_stop()
+#endif
+
+static unsigned char rng90_buffer[RNG90_BUFFER_SIZE];
+static unsigned char rng90_address = RNG90_ADDRESS;
+static volatile RNG90_Statistics rng90_statistics_data;
+static volatile unsigned char rng90_statistics_sequence;
+
+static RNG90_Device_Type rng90_device_type = RNG90_Device_RNG90;
+
+static RNG90_Timing rng90_timing_data[RNG90_DEVICE_TYPES] = {
+	{
+		RNG90_INFO_EXECUTION_TIME_MS,
+		RNG90_RANDOM_EXECUTION_TIME_MS,
+		RNG90_READ_EXECUTION_TIME_MS,
+		RNG90_SELFTEST_EXECUTION_TIME_MS
+	},
+	{
+		RNG90_ATECC608_INFO_EXECUTION_TIME_MS,
+		RNG90_ATECC608_RANDOM_EXECUTION_TIME_MS,
+		RNG90_ATECC608_READ_EXECUTION_TIME_MS,
+		RNG90_ATECC608_SELFTEST_EXECUTION_TIME_MS
+	}
+};
+
+static const unsigned char rng90_random_opcode[RNG90_DEVICE_TYPES] = {
+	RNG90_OPERATION_RANDOM,
+	RNG90_ATECC608_OPERATION_RANDOM
+};
+
+static const unsigned char rng90_random_data_size[RNG90_DEVICE_TYPES] = {
+	RNG90_OPERATION_RANDOM_DATA_SIZE,
+	RNG90_ATECC608_OPERATION_RANDOM_DATA_SIZE
+};
+
+static unsigned char rng90_reservoir[RNG90_OPERATION_RANDOM_RNG_SIZE];
+static unsigned char rng90_reservoir_available;
 
 /**
  * @brief Initializes the RNG90 device by running a self-test.
@@ -29,10 +90,12 @@ unsigned char rng90_buffer[87];
  * - `RNG90_Status_SelfTest_Error` if the DRBG self-test failed and the device should not be used.
  * 
  * @details
- * This function performs an initialization sequence for the RNG90 device by invoking the `rng90_selftest()` routine with `RNG90_Run_DRBG_SelfTest` to verify the deterministic random bit generator (DRBG) functionality. If the self-test does not report `RNG90_SelfTest_Success`, the function returns RNG90_Status_SelfTest_Error` to indicate that the device failed initialization. When the DRBG self-test completes successfully, the function returns `RNG90_Status_Success`, signaling that the RNG90 is ready for normal operation.
+ * This function performs an initialization sequence for the RNG90 device by invoking the `rng90_selftest()` routine with `RNG90_Run_DRBG_SelfTest` to verify the deterministic random bit generator (DRBG) functionality. If the self-test does not report `RNG90_SelfTest_Success`, the function returns RNG90_Status_SelfTest_Error` to indicate that the device failed initialization. When the DRBG self-test completes successfully, the function returns `RNG90_Status_Success`, signaling that the RNG90 is ready for normal operation. Random bytes buffered by `rng90_random_bytes()` are discarded beforehand.
  */
 RNG90_Status rng90_init(void)
 {
+	rng90_discard();
+	
     if(rng90_selftest(RNG90_Run_DRBG_SelfTest) != RNG90_SelfTest_Success)
     {
         return RNG90_Status_SelfTest_Error;
@@ -40,38 +103,179 @@ RNG90_Status rng90_init(void)
 	return RNG90_Status_Success;
 }
 
-static void rng90_write(RNG90_Packet *packet)
+/**
+ * @brief Selects the RNG90 device used by subsequent driver calls.
+ *
+ * @param address 7-bit TWI/I2C address of the RNG90 device.
+ *
+ * @details
+ * This function sets the TWI/I2C address used by all following commands, so several RNG90 devices with different addresses can be operated by one driver instance. After startup, the device at `RNG90_ADDRESS` is selected.
+ */
+void rng90_select(unsigned char address)
+{
+	rng90_address = address;
+}
+
+/**
+ * @brief Selects the type of the device used by subsequent driver calls.
+ *
+ * @param type Device type from ::RNG90_Device_Type.
+ *
+ * @details
+ * The RNG90 shares its command framing (word address, count/opcode/param1/param2, CRC-16 and the info and self-test opcodes) with other CryptoAuthentication devices such as the ATECC608. This function selects the random command opcode and layout as well as the execution times of the given device type, so random numbers can be drawn from all of these devices by the same driver. Use it together with `rng90_select()` to address a device; queued requests store the type selected at submission time. After startup, `RNG90_Device_RNG90` is selected.
+ *
+ * @note Only the random, info and self-test commands are shared. `rng90_serial()` reads the serial number layout of the RNG90. ATECC608 devices additionally have to be woken up by the application before a command is sent.
+ *
+ * @note An invalid @p type (not below `RNG90_DEVICE_TYPES`) is ignored and the previously selected type is kept.
+ */
+void rng90_select_type(RNG90_Device_Type type)
+{
+	if(type < RNG90_DEVICE_TYPES)
+	{
+		rng90_device_type = type;
+	}
+}
+
+/**
+ * @brief Sets the execution times used by the driver.
+ *
+ * @param timing Pointer to an ::RNG90_Timing structure with the new execution times in milliseconds.
+ *
+ * @details
+ * This function replaces the execution times the driver waits (or, with `RNG90_ACK_POLLING` enabled, polls at most) after sending a command to a device of the currently selected type (see `rng90_select_type()`). It allows tuning the timing profile of a product at runtime, e.g. from a configuration stored in EEPROM, instead of rebuilding with different `RNG90_*_EXECUTION_TIME_MS` values. A command that is already executing in `rng90_service()` keeps the time it was started with, the new values apply to the following commands.
+ */
+void rng90_timing_set(const RNG90_Timing *timing)
+{
+	rng90_timing_data[rng90_device_type] = *timing;
+}
+
+/**
+ * @brief Reads the execution times currently used by the driver.
+ *
+ * @param timing Pointer to an ::RNG90_Timing structure that will be filled with the current execution times in milliseconds.
+ *
+ * @details
+ * This function returns the execution times of the currently selected device type (see `rng90_select_type()`). After startup the execution times equal the `RNG90_*_EXECUTION_TIME_MS` (or `RNG90_ATECC608_*_EXECUTION_TIME_MS`) configuration macros.
+ */
+void rng90_timing_get(RNG90_Timing *timing)
+{
+	*timing = rng90_timing_data[rng90_device_type];
+}
+
+#if RNG90_HAL_RUNTIME
+/**
+ * @brief Selects the TWI/I2C operations used by subsequent driver calls.
+ *
+ * @param hal Pointer to an ::RNG90_HAL operations table. The table must remain valid while it is selected.
+ *
+ * @details
+ * This function is only available if `RNG90_HAL_RUNTIME` is enabled. It sets the bus implementation used by all following commands, so devices on different buses (or a simulator and real hardware) can be operated from one firmware image. Together with `rng90_select()` it identifies the device that is addressed. A bus has to be selected before any other driver function is called. Queued requests store the bus selected at submission time.
+ */
+void rng90_hal(const RNG90_HAL *hal)
+{
+	rng90_hal_current = hal;
+}
+#endif
+
+static void rng90_count(volatile unsigned long *counter)
+{
+	rng90_statistics_sequence++;
+	(*counter)++;
+	rng90_statistics_sequence++;
+}
+
+static void rng90_clear(unsigned char *data, unsigned char length)
+{
+	volatile unsigned char *ptr = data;
+	
+	for (unsigned char i=0; i < length; i++)
+	{
+		*(ptr + i) = 0x00;
+	}
+}
+
+#if RNG90_ACK_POLLING
+static unsigned char rng90_ready(void)
+{
+	RNG90_TWI_START();
+	unsigned char ready = (RNG90_TWI_ADDRESS(rng90_address, TWI_Write) == TWI_None);
+	RNG90_TWI_STOP();
+	
+	if(ready)
+	{
+		return 1;
+	}
+	rng90_count(&rng90_statistics_data.polls);
+	return 0;
+}
+
+static unsigned long rng90_poll_delay(unsigned long time_ms)
+{
+	return (time_ms * RNG90_POLLING_DELAY_PERCENT) / 100;
+}
+
+static void rng90_poll(unsigned long time_ms)
+{
+	for (unsigned long i=0; i < time_ms; i += RNG90_POLLING_INTERVAL_MS)
+	{
+		systick_timer_wait_ms(RNG90_POLLING_INTERVAL_MS);
+		
+		if(rng90_ready())
+		{
+			return;
+		}
+	}
+}
+#endif
+
+static void rng90_wait(unsigned long time_ms)
+{
+#if RNG90_ACK_POLLING
+	unsigned long delay_ms = rng90_poll_delay(time_ms);
+	
+	if(delay_ms > 0)
+	{
+		systick_timer_wait_ms(delay_ms);
+	}
+	rng90_poll(time_ms - delay_ms);
+#else
+	systick_timer_wait_ms(time_ms);
+#endif
+}
+
+static TWI_Error rng90_write(RNG90_Packet *packet)
 {
     unsigned char *ptr = (unsigned char *)packet;
 	packet->count += 7;
 
 	crc16_init(CRC16_INITIAL_VALUE);
 
-    twi_address(RNG90_ADDRESS, TWI_Write);
-    twi_set(RNG90_EXECUTE_COMMAND);
+    TWI_Error error = RNG90_TWI_ADDRESS(rng90_address, TWI_Write);
+    RNG90_TWI_SET(RNG90_EXECUTE_COMMAND);
 	
     for (unsigned char i=0; i < (sizeof(RNG90_Packet) - RNG90_CRC_SIZE); i++)
     {
 		crc16_update(*(ptr + i));
-        twi_set(*(ptr + i));
+        RNG90_TWI_SET(*(ptr + i));
     }
+	return error;
 }
 
 static void rng90_command(RNG90_Packet *packet)
 {
-    twi_start();
+    RNG90_TWI_START();
     rng90_write(packet);
 	
 	packet->crc = crc16_result();
 	
-    twi_set((unsigned char)(0x00FF & packet->crc));
-    twi_set((unsigned char)(0x00FF & (packet->crc>>8)));
-    twi_stop();
+    RNG90_TWI_SET((unsigned char)(0x00FF & packet->crc));
+    RNG90_TWI_SET((unsigned char)(0x00FF & (packet->crc>>8)));
+    RNG90_TWI_STOP();
 }
 
 static RNG90_Frame rng90_frame;
 
-static RNG90_Frame rng90_data(unsigned char *data)
+static RNG90_Frame rng90_data(unsigned char *data, unsigned char size)
 {
 	crc16_init(CRC16_INITIAL_VALUE);
 	
@@ -81,12 +285,12 @@ static RNG90_Frame rng90_data(unsigned char *data)
 	rng90_frame.length = 1 + RNG90_CRC_SIZE;
 	rng90_frame.status = RNG90_Data_Status_Invalid;
 	
-    twi_start();
-    twi_address(RNG90_ADDRESS, TWI_Read);
+    RNG90_TWI_START();
+    RNG90_TWI_ADDRESS(rng90_address, TWI_Read);
 	
     for (unsigned char i=0; i < rng90_frame.length - RNG90_CRC_SIZE; i++)
     {	
-		twi_get(&temp, TWI_ACK);
+		RNG90_TWI_GET(&temp, TWI_ACK);
         crc16_update(temp);
 		
 		if(i == 0)
@@ -94,22 +298,32 @@ static RNG90_Frame rng90_data(unsigned char *data)
 			rng90_frame.length = temp;
 			continue;
 		}
-		*(data + i - 1) = temp;
+		
+		if(i <= size)
+		{
+			*(data + i - 1) = temp;
+		}
     }
 	
-	twi_get(&temp, TWI_ACK);
+	RNG90_TWI_GET(&temp, TWI_ACK);
 	crc = (0x00FF & temp);
-	twi_get(&temp, TWI_NACK);
+	RNG90_TWI_GET(&temp, TWI_NACK);
 	crc |= (0xFF00 & (temp<<8));
 
-    twi_stop();
+    RNG90_TWI_STOP();
 	
 	rng90_frame.status = RNG90_Data_Status_Valid;
+	rng90_count(&rng90_statistics_data.frames);
 
     if (crc != crc16_result())
     {
 	    rng90_frame.status = RNG90_Data_Status_Invalid;
+		rng90_count(&rng90_statistics_data.crc_errors);
     }
+	else if ((rng90_frame.length == RNG90_STANDARD_FRAME_SIZE) && (*data != RNG90_STATUS_SUCCESSFUL_COMMAND_EXECUTION))
+	{
+		rng90_count(&rng90_statistics_data.status_frames);
+	}
     return rng90_frame;
 }
 
@@ -135,6 +349,8 @@ static RNG90_Frame rng90_data(unsigned char *data)
  */
 RNG90_SelfTest_Status rng90_selftest(RNG90_Run_SelfTest test)
 {
+    RNG90_RECORD_REQUEST(RNG90_OPERATION_SELF_TEST, 0);
+	
     RNG90_Packet packet;
     packet.count = 0;
     packet.opcode = RNG90_OPERATION_SELF_TEST;
@@ -143,9 +359,9 @@ RNG90_SelfTest_Status rng90_selftest(RNG90_Run_SelfTest test)
 	packet.crc = 0x0000;
 
     rng90_command(&packet);
-	systick_timer_wait_ms(RNG90_SELFTEST_EXECUTION_TIME_MS);
+	rng90_wait(rng90_timing_data[rng90_device_type].selftest_ms);
 	
-	RNG90_Frame frame = rng90_data(rng90_buffer);
+	RNG90_Frame frame = rng90_data(rng90_buffer, sizeof(rng90_buffer));
 	
 	if((frame.length == RNG90_STANDARD_FRAME_SIZE) && (frame.status == RNG90_Data_Status_Valid))
 	{
@@ -177,6 +393,8 @@ RNG90_SelfTest_Status rng90_selftest(RNG90_Run_SelfTest test)
  */
 RNG90_Status rng90_info(RNG90_Info *info)
 {
+	RNG90_RECORD_REQUEST(RNG90_OPERATION_INFO, 0);
+	
 	RNG90_Packet packet;
 	packet.count = 0;
 	packet.opcode = RNG90_OPERATION_INFO;
@@ -185,9 +403,9 @@ RNG90_Status rng90_info(RNG90_Info *info)
 	packet.crc = 0x0000;
 
 	rng90_command(&packet);
-    systick_timer_wait_ms(RNG90_INFO_EXECUTION_TIME_MS);
+    rng90_wait(rng90_timing_data[rng90_device_type].info_ms);
 
-	RNG90_Frame frame = rng90_data(rng90_buffer);
+	RNG90_Frame frame = rng90_data(rng90_buffer, sizeof(rng90_buffer));
 	
 	if((frame.length == RNG90_STANDARD_FRAME_SIZE) && (frame.status == RNG90_Data_Status_Valid))
 	{
@@ -204,6 +422,130 @@ RNG90_Status rng90_info(RNG90_Info *info)
 	return RNG90_Status_Other_Error;
 }
 
+static RNG90_Status rng90_random_command(void)
+{
+	RNG90_Packet packet;
+	packet.count = rng90_random_data_size[rng90_device_type];
+	packet.opcode = rng90_random_opcode[rng90_device_type];
+	packet.param1 = RNG90_OPERATION_RANDOM_PARAM1;
+	packet.param2 = RNG90_OPERATION_RANDOM_PARAM2;
+	packet.crc = 0x0000;
+	
+    RNG90_TWI_START();
+	
+    if(rng90_write(&packet) != TWI_None)
+    {
+        RNG90_TWI_STOP();
+		rng90_count(&rng90_statistics_data.twi_errors);
+        return RNG90_Status_TWI_Error;
+    }
+
+    for (unsigned char i=0; i < rng90_random_data_size[rng90_device_type]; i++)
+    {
+        if(RNG90_TWI_SET(RNG90_OPERATION_RANDOM_DATA) != TWI_None)
+        {
+            RNG90_TWI_STOP();
+			rng90_count(&rng90_statistics_data.twi_errors);
+            return RNG90_Status_TWI_Error;
+        }
+        crc16_update(RNG90_OPERATION_RANDOM_DATA);
+    }
+	packet.crc = crc16_result();
+	
+	RNG90_TWI_SET((unsigned char)(0x00FF & packet.crc));
+	RNG90_TWI_SET((unsigned char)(0x00FF & (packet.crc>>8)));
+	RNG90_TWI_STOP();
+	
+	return RNG90_Status_Success;
+}
+
+#if RNG90_REPEAT_DETECTION_BLOCKS
+static RNG90_Repeat rng90_repeat;
+
+/**
+ * @brief Checks whether a random block repeats one of the recently checked blocks.
+ *
+ * @param repeat Pointer to an ::RNG90_Repeat history that holds the fingerprints of the previous blocks. A new history has to be zero-initialized.
+ * @param numbers Pointer to a block of `RNG90_OPERATION_RANDOM_RNG_SIZE` random bytes.
+ *
+ * @return Returns `1` if the fingerprint of @p numbers matches one of the last `RNG90_REPEAT_DETECTION_BLOCKS` blocks in @p repeat, otherwise `0`.
+ *
+ * @details
+ * This function folds the block into a 32-bit fingerprint and compares it with the fingerprints of the previous blocks, which are kept in a ring of fixed size. The fingerprint of @p numbers is added to the ring afterwards. A device that replays earlier output is detected this way, while a genuine repetition only occurs with a probability of about `RNG90_REPEAT_DETECTION_BLOCKS` / 2^32 per block. The driver checks every random block it receives against its own internal history and reports a repetition as `RNG90_Status_HealthTest_Error`. To check previously captured random data, the application passes a separate history, so the online history of the driver is not affected.
+ *
+ * @note Only available if `RNG90_REPEAT_DETECTION_BLOCKS` is greater than zero.
+ */
+unsigned char rng90_repeat_check(RNG90_Repeat *repeat, const unsigned char *numbers)
+{
+	unsigned long fingerprint = 0;
+	
+	for (unsigned char i=0; i < RNG90_OPERATION_RANDOM_RNG_SIZE; i += 4)
+	{
+		fingerprint ^= ((unsigned long)numbers[i] << 24) | ((unsigned long)numbers[i + 1] << 16) | ((unsigned long)numbers[i + 2] << 8) | numbers[i + 3];
+	}
+	
+	for (unsigned int i=0; i < repeat->count; i++)
+	{
+		if(repeat->fingerprints[i] == fingerprint)
+		{
+			return 1;
+		}
+	}
+	
+	repeat->fingerprints[repeat->index] = fingerprint;
+	
+	if(++repeat->index >= RNG90_REPEAT_DETECTION_BLOCKS)
+	{
+		repeat->index = 0;
+	}
+	
+	if(repeat->count < RNG90_REPEAT_DETECTION_BLOCKS)
+	{
+		repeat->count++;
+	}
+	return 0;
+}
+#endif
+
+static RNG90_Status rng90_random_response(unsigned char *numbers)
+{
+	RNG90_Frame frame = rng90_data(numbers, RNG90_OPERATION_RANDOM_RNG_SIZE);
+	
+	if((frame.length == RNG90_STANDARD_FRAME_SIZE) && (frame.status == RNG90_Data_Status_Valid))
+	{
+		if(numbers[0] == RNG90_STATUS_SUCCESSFUL_COMMAND_EXECUTION)
+		{
+			return RNG90_Status_Other_Error;
+		}
+		return (RNG90_Status)(numbers[0]);
+	}
+	else if (frame.length == RNG90_NUMBER_FRAME_SIZE && (frame.status == RNG90_Data_Status_Valid))
+	{
+#if RNG90_REPEAT_DETECTION_BLOCKS
+		if(rng90_repeat_check(&rng90_repeat, numbers))
+		{
+			return RNG90_Status_HealthTest_Error;
+		}
+#endif
+		rng90_count(&rng90_statistics_data.random_blocks);
+		return RNG90_Status_Success;
+	}
+	return RNG90_Status_Other_Error;
+}
+
+static RNG90_Status rng90_random_block(unsigned char *numbers)
+{
+	RNG90_Status status = rng90_random_command();
+	
+	if(status != RNG90_Status_Success)
+	{
+		return status;
+	}
+    rng90_wait(rng90_timing_data[rng90_device_type].random_ms);
+	
+	return rng90_random_response(numbers);
+}
+
 /**
  * @brief Requests random numbers from the RNG90 device and stores them in a buffer.
  *
@@ -216,55 +558,251 @@ RNG90_Status rng90_info(RNG90_Info *info)
  * - `RNG90_Status_TWI_Error` if a TWI/I2C transmission error occurred while sending the command or payload.
  * - `RNG90_Status_SelfTest_Error` (cast from the buffer) if the response is a self-test status frame instead of random data.
  * - `RNG90_Status_Other_Error` if the response frame is invalid, has an unexpected length,
- *   or another communication/parse error occurred.
+ *   is a status frame reporting success without random data, or another communication/parse error occurred.
  *
  * @details
- * This function sends a random-number request to the RNG90 device, transmits the associated payload and CRC over TWI/I2C, and then reads back the response frame. Depending on the response type, it either copies the received random bytes into @p numbers or returns an appropriate status code.
+ * This function sends a random-number request to the RNG90 device, transmits the associated payload and CRC over TWI/I2C, and then reads back the response frame. The received random bytes are read directly into @p numbers, so no copy of the random data remains in driver memory. Depending on the response type, it either returns `RNG90_Status_Success` or an appropriate status code.
+ *
+ * @warning If an error is returned, the content of @p numbers is undefined and must not be used as random data.
  */
 RNG90_Status rng90_random(unsigned char *numbers)
 {
-	RNG90_Packet packet;
-	packet.count = RNG90_OPERATION_RANDOM_DATA_SIZE;
-	packet.opcode = RNG90_OPERATION_RANDOM;
-	packet.param1 = RNG90_OPERATION_RANDOM_PARAM1;
-	packet.param2 = RNG90_OPERATION_RANDOM_PARAM2;
-	packet.crc = 0x0000;
+	RNG90_RECORD_REQUEST(RNG90_OPERATION_RANDOM, RNG90_OPERATION_RANDOM_RNG_SIZE);
 	
-    twi_start();
-    rng90_write(&packet);
+	return rng90_random_block(numbers);
+}
 
-    for (unsigned char i=0; i < RNG90_OPERATION_RANDOM_DATA_SIZE; i++)
-    {
-        if(twi_set(RNG90_OPERATION_RANDOM_DATA) != TWI_None)
-        {
-            twi_stop();
-            return RNG90_Status_TWI_Error;
-        }
-        crc16_update(RNG90_OPERATION_RANDOM_DATA);
-    }
-	packet.crc = crc16_result();
+/**
+ * @brief Requests one random block from each of several RNG90 devices in parallel.
+ *
+ * @param addresses Pointer to an array with the TWI/I2C addresses of the RNG90 devices.
+ * @param count Number of devices in @p addresses.
+ * @param numbers Pointer to a buffer where the received random bytes will be stored, one block per device in the order of @p addresses.
+ *
+ * @warning The buffer must be able to hold at least @p count * `RNG90_OPERATION_RANDOM_RNG_SIZE` bytes.
+ *
+ * @return Returns `RNG90_Status_Success` if every device delivered a valid random block, otherwise the status code of the first device that failed (see `rng90_random()`).
+ *
+ * @details
+ * All devices have to be of the currently selected type (see `rng90_select_type()`). This function first sends the random command to all devices, then waits the random execution time once (or polls each device if `RNG90_ACK_POLLING` is enabled) and finally reads the responses one after another. Because the devices generate their random numbers concurrently, the throughput scales with the number of devices instead of paying the execution time for every device. The device selected with `rng90_select()` is restored before the function returns.
+ *
+ * @warning If an error is returned, the content of @p numbers is undefined and must not be used as random data.
+ */
+RNG90_Status rng90_random_devices(const unsigned char *addresses, unsigned char count, unsigned char *numbers)
+{
+	RNG90_RECORD_REQUEST(RNG90_OPERATION_RANDOM, count * RNG90_OPERATION_RANDOM_RNG_SIZE);
+	
+	unsigned char address = rng90_address;
+	RNG90_Status status = RNG90_Status_Success;
+	
+	for (unsigned char i=0; (i < count) && (status == RNG90_Status_Success); i++)
+	{
+		rng90_address = addresses[i];
+		status = rng90_random_command();
+	}
+	
+	for (unsigned char i=0; (i < count) && (status == RNG90_Status_Success); i++)
+	{
+		rng90_address = addresses[i];
+		
+		if(i == 0)
+		{
+			rng90_wait(rng90_timing_data[rng90_device_type].random_ms);
+		}
+#if RNG90_ACK_POLLING
+		else
+		{
+			rng90_poll(rng90_timing_data[rng90_device_type].random_ms);
+		}
+#endif
+		status = rng90_random_response(numbers + (i * RNG90_OPERATION_RANDOM_RNG_SIZE));
+	}
 	
-	twi_set((unsigned char)(0x00FF & packet.crc));
-	twi_set((unsigned char)(0x00FF & (packet.crc>>8)));
-	twi_stop();
+	rng90_address = address;
+	return status;
+}
 
-    systick_timer_wait_ms(RNG90_RANDOM_EXECUTION_TIME_MS);
+/**
+ * @brief Fills a buffer of arbitrary length with random numbers from the RNG90 device.
+ *
+ * @param buffer Pointer to a buffer where the received random bytes will be stored.
+ * @param length Number of random bytes to write into @p buffer.
+ *
+ * @return Returns one of the following status codes:
+ * - `RNG90_Status_Success` if @p length random bytes were written to @p buffer.
+ * - `RNG90_Status_TWI_Error` if a TWI/I2C transmission error occurred while sending a command.
+ * - `RNG90_Status_SelfTest_Error` (cast from the buffer) if a response is a self-test status frame instead of random data.
+ * - `RNG90_Status_Other_Error` if a response frame is invalid, has an unexpected length, is a status frame reporting success without random data, or another communication/parse error occurred.
+ *
+ * @details
+ * This function requests as many random blocks as required to fill @p buffer. Full blocks of `RNG90_OPERATION_RANDOM_RNG_SIZE` bytes are read from the TWI/I2C bus directly into @p buffer without passing through the driver buffer, only a trailing partial block is copied. This makes the function suitable for bulk output (e.g. filling a transmit or storage buffer) without an additional copy per block.
+ *
+ * @warning If an error is returned, the content of @p buffer is undefined and must not be used as random data.
+ */
+RNG90_Status rng90_stream(unsigned char *buffer, unsigned int length)
+{
+	RNG90_RECORD_REQUEST(RNG90_OPERATION_RANDOM, length);
 	
-	RNG90_Frame frame = rng90_data(rng90_buffer);
+	RNG90_Status status;
 	
-	if((frame.length == RNG90_STANDARD_FRAME_SIZE) && (frame.status == RNG90_Data_Status_Valid))
+	while (length >= RNG90_OPERATION_RANDOM_RNG_SIZE)
 	{
-		return (RNG90_SelfTest_Status)(rng90_buffer[0]);
+		status = rng90_random_block(buffer);
+		
+		if(status != RNG90_Status_Success)
+		{
+			return status;
+		}
+		buffer += RNG90_OPERATION_RANDOM_RNG_SIZE;
+		length -= RNG90_OPERATION_RANDOM_RNG_SIZE;
 	}
-	else if (frame.length == RNG90_NUMBER_FRAME_SIZE && (frame.status == RNG90_Data_Status_Valid))
+	
+	if(length > 0)
 	{
-		for (unsigned char i=0; i < RNG90_OPERATION_RANDOM_RNG_SIZE; i++)
+		status = rng90_random_block(rng90_buffer);
+		
+		if(status == RNG90_Status_Success)
 		{
-			*(numbers + i) = rng90_buffer[i];
+			for (unsigned char i=0; i < length; i++)
+			{
+				*(buffer + i) = rng90_buffer[i];
+			}
 		}
-		return RNG90_Status_Success;
+		rng90_clear(rng90_buffer, sizeof(rng90_buffer));
+		return status;
 	}
-	return RNG90_Status_Other_Error;
+	return RNG90_Status_Success;
+}
+
+/**
+ * @brief Provides a small number of random bytes, combining several calls into one device command.
+ *
+ * @param buffer Pointer to a buffer where the random bytes will be stored.
+ * @param length Number of random bytes to write into @p buffer.
+ *
+ * @return Returns `RNG90_Status_Success` if @p length random bytes were written to @p buffer, otherwise the status code of the failed random command (see `rng90_random()`).
+ *
+ * @details
+ * This function serves the requested bytes from a reservoir holding the unused rest of the last random block. Only when the reservoir is empty a new block of `RNG90_OPERATION_RANDOM_RNG_SIZE` bytes is requested from the device, so many small requests (e.g. single integers or identifiers) share one device command instead of paying the execution time each. Every byte handed out is removed from the reservoir and cleared, so no byte is ever served twice.
+ */
+RNG90_Status rng90_random_bytes(unsigned char *buffer, unsigned char length)
+{
+	RNG90_RECORD_REQUEST(RNG90_OPERATION_RANDOM, length);
+	
+	RNG90_Status status;
+	
+	for (unsigned char i=0; i < length; i++)
+	{
+		if(rng90_reservoir_available == 0)
+		{
+			status = rng90_random_block(rng90_reservoir);
+			
+			if(status != RNG90_Status_Success)
+			{
+				rng90_clear(rng90_reservoir, RNG90_OPERATION_RANDOM_RNG_SIZE);
+				return status;
+			}
+			rng90_reservoir_available = RNG90_OPERATION_RANDOM_RNG_SIZE;
+		}
+		rng90_reservoir_available--;
+		
+		*(buffer + i) = rng90_reservoir[rng90_reservoir_available];
+		rng90_clear(&rng90_reservoir[rng90_reservoir_available], 1);
+	}
+	return RNG90_Status_Success;
+}
+
+/**
+ * @brief Discards all random bytes buffered by the driver.
+ *
+ * @details
+ * This function clears the reservoir of `rng90_random_bytes()`, so the following request is served from a new device command. It has to be called whenever a copy of the driver state could hand out the same bytes a second time, e.g. in the child process after a `fork()` on a hosted port (`pthread_atfork(0, 0, rng90_discard)`) or after restoring a RAM snapshot. The call costs nothing on the regular request path.
+ */
+void rng90_discard(void)
+{
+	rng90_clear(rng90_reservoir, RNG90_OPERATION_RANDOM_RNG_SIZE);
+	rng90_reservoir_available = 0;
+}
+
+/**
+ * @brief Provides a 32-bit random number.
+ *
+ * @param value Pointer to a variable that receives the random number.
+ *
+ * @return Returns `RNG90_Status_Success` if @p value was written, otherwise the status code of the failed random command (see `rng90_random()`).
+ *
+ * @details
+ * This function takes four bytes from the reservoir of `rng90_random_bytes()`, so eight consecutive calls are served by a single device command.
+ */
+RNG90_Status rng90_random_u32(unsigned long *value)
+{
+	unsigned char bytes[4];
+	RNG90_Status status = rng90_random_bytes(bytes, sizeof(bytes));
+	
+	if(status == RNG90_Status_Success)
+	{
+		*value = ((unsigned long)bytes[0] << 24) | ((unsigned long)bytes[1] << 16) | ((unsigned long)bytes[2] << 8) | bytes[3];
+	}
+	rng90_clear(bytes, sizeof(bytes));
+	return status;
+}
+
+/**
+ * @brief Provides a uniformly distributed random number below an upper bound.
+ *
+ * @param bound Exclusive upper bound of the random number, must be in the range `1` to `0xFFFFFFFF`.
+ * @param value Pointer to a variable that receives a random number in the range `0` to @p bound - 1.
+ *
+ * @return Returns `RNG90_Status_Success` if @p value was written, `RNG90_Status_Parse_Error` if @p bound is zero or larger than `0xFFFFFFFF`, otherwise the status code of the failed random command (see `rng90_random()`).
+ *
+ * @details
+ * This function draws 32-bit random numbers with `rng90_random_u32()` and rejects values from the incomplete last interval, so the result has no modulo bias.
+ */
+RNG90_Status rng90_random_range(unsigned long bound, unsigned long *value)
+{
+	unsigned long random;
+	RNG90_Status status;
+	
+	if((bound == 0) || (bound > 0xFFFFFFFFUL))
+	{
+		return RNG90_Status_Parse_Error;
+	}
+	unsigned long limit = 0xFFFFFFFFUL - (0xFFFFFFFFUL % bound);
+	
+	do
+	{
+		status = rng90_random_u32(&random);
+		
+		if(status != RNG90_Status_Success)
+		{
+			return status;
+		}
+	} while (random >= limit);
+	
+	*value = random % bound;
+	return RNG90_Status_Success;
+}
+
+/**
+ * @brief Provides a random (version 4) UUID.
+ *
+ * @param uuid Pointer to a buffer of at least `RNG90_UUID_SIZE` bytes that receives the UUID in binary form (network byte order).
+ *
+ * @return Returns `RNG90_Status_Success` if @p uuid was written, otherwise the status code of the failed random command (see `rng90_random()`).
+ *
+ * @details
+ * This function takes `RNG90_UUID_SIZE` bytes from the reservoir of `rng90_random_bytes()` and sets the version and variant bits according to RFC 4122, so two UUIDs are served by a single device command.
+ */
+RNG90_Status rng90_random_uuid(unsigned char *uuid)
+{
+	RNG90_Status status = rng90_random_bytes(uuid, RNG90_UUID_SIZE);
+	
+	if(status == RNG90_Status_Success)
+	{
+		uuid[6] = (uuid[6] & 0x0F) | 0x40;
+		uuid[8] = (uuid[8] & 0x3F) | 0x80;
+	}
+	return status;
 }
 
 /**
@@ -284,6 +822,8 @@ RNG90_Status rng90_random(unsigned char *numbers)
  */
 RNG90_Status rng90_serial(unsigned char *serial)
 {
+	RNG90_RECORD_REQUEST(RNG90_OPERATION_READ, 0);
+	
 	RNG90_Packet packet;
 	packet.count = 0;
 	packet.opcode = RNG90_OPERATION_READ;
@@ -292,9 +832,9 @@ RNG90_Status rng90_serial(unsigned char *serial)
 	packet.crc = 0x0000;
 	
 	rng90_command(&packet);
-    systick_timer_wait_ms(RNG90_READ_EXECUTION_TIME_MS);
+    rng90_wait(rng90_timing_data[rng90_device_type].read_ms);
 
-    RNG90_Frame frame = rng90_data(rng90_buffer);
+    RNG90_Frame frame = rng90_data(rng90_buffer, sizeof(rng90_buffer));
     
     if((frame.length == RNG90_STANDARD_FRAME_SIZE) && (frame.status == RNG90_Data_Status_Valid))
     {
@@ -309,4 +849,438 @@ RNG90_Status rng90_serial(unsigned char *serial)
 	    return RNG90_Status_Success;
     }
     return RNG90_Status_Other_Error;
+}
+
+/**
+ * @brief Feeds random blocks from the RNG90 into a sink according to its demand.
+ *
+ * @param sink Pointer to an ::RNG90_Sink that reports its demand and consumes the random blocks.
+ *
+ * @return Returns one of the following status codes:
+ * - `RNG90_Status_Success` if the sink demand was served (or no demand was reported).
+ * - Any status code returned by `rng90_random()` if a block could not be read from the device. Blocks read before the error have already been passed to the sink.
+ *
+ * @details
+ * This function queries the demand of @p sink and reads up to `RNG90_FEED_BATCH_BLOCKS` blocks from the RNG90 device, passing every block to the write callback of the sink. If the sink reports no demand, the device is not accessed at all, which keeps bus traffic and device usage minimal while the consumer is saturated. The local block buffer is cleared before the function returns so that no random material is left on the stack.
+ */
+RNG90_Status rng90_feed(const RNG90_Sink *sink)
+{
+	unsigned char numbers[RNG90_OPERATION_RANDOM_RNG_SIZE];
+	RNG90_Status status = RNG90_Status_Success;
+	
+	unsigned char blocks = sink->demand();
+	
+	if(blocks > RNG90_FEED_BATCH_BLOCKS)
+	{
+		blocks = RNG90_FEED_BATCH_BLOCKS;
+	}
+	
+	for (unsigned char i=0; i < blocks; i++)
+	{
+		status = rng90_random(numbers);
+		
+		if(status != RNG90_Status_Success)
+		{
+			break;
+		}
+		sink->write(numbers);
+	}
+	
+	rng90_clear(numbers, RNG90_OPERATION_RANDOM_RNG_SIZE);
+	return status;
+}
+
+/**
+ * @brief Copies the driver statistics counters into a caller-provided structure.
+ *
+ * @param statistics Pointer to an ::RNG90_Statistics structure that will be filled with the current counter values.
+ *
+ * @details
+ * This function provides the number of response frames read, random blocks delivered, CRC errors, device status frames, TWI/I2C errors and unanswered polls counted by the driver since startup or the last call to `rng90_statistics_reset()`. The counters can be used by monitoring or diagnostic tools to assess the condition and throughput of a device in the field. Polls are only counted after the initial delay set by `RNG90_POLLING_DELAY_PERCENT`, so the poll counter multiplied by `RNG90_POLLING_INTERVAL_MS` shows how long the devices took beyond that delay, which helps to tune it.
+ *
+ * The counters are protected by a sequence counter that the driver increments before and after every update. The copy is repeated until it was taken while no update was in progress, so a consistent snapshot is returned even if it is called from another task than the one running the driver (e.g. a monitoring task of a scheduler), without disabling interrupts or locking on the driver side.
+ *
+ * @warning This function must not be called from a context that interrupts the driver (e.g. an interrupt service routine preempting `rng90_service()`), since it would wait for an update that cannot complete.
+ */
+void rng90_statistics(RNG90_Statistics *statistics)
+{
+	unsigned char sequence;
+	
+	do
+	{
+		sequence = rng90_statistics_sequence;
+		
+		statistics->frames = rng90_statistics_data.frames;
+		statistics->random_blocks = rng90_statistics_data.random_blocks;
+		statistics->crc_errors = rng90_statistics_data.crc_errors;
+		statistics->status_frames = rng90_statistics_data.status_frames;
+		statistics->twi_errors = rng90_statistics_data.twi_errors;
+		statistics->polls = rng90_statistics_data.polls;
+	} while ((sequence & 0x01) || (sequence != rng90_statistics_sequence));
+}
+
+/**
+ * @brief Resets all driver statistics counters to zero.
+ *
+ * @details
+ * This function clears the counters returned by `rng90_statistics()`, e.g. to start a new measurement interval.
+ */
+void rng90_statistics_reset(void)
+{
+	rng90_statistics_sequence++;
+	
+	rng90_statistics_data.frames = 0;
+	rng90_statistics_data.random_blocks = 0;
+	rng90_statistics_data.crc_errors = 0;
+	rng90_statistics_data.status_frames = 0;
+	rng90_statistics_data.twi_errors = 0;
+	rng90_statistics_data.polls = 0;
+	
+	rng90_statistics_sequence++;
+}
+
+static RNG90_Request rng90_submission[RNG90_QUEUE_SIZE];
+static RNG90_Request rng90_completion[RNG90_QUEUE_SIZE];
+
+static volatile unsigned char rng90_submission_head;
+static volatile unsigned char rng90_submission_tail;
+static volatile unsigned char rng90_completion_head;
+static volatile unsigned char rng90_completion_tail;
+
+static unsigned char rng90_request_active;
+static unsigned long rng90_request_remaining_ms;
+#if RNG90_ACK_POLLING
+static unsigned long rng90_request_polling_ms;
+#endif
+
+static unsigned char rng90_request_address;
+static RNG90_Device_Type rng90_request_type;
+#if RNG90_HAL_RUNTIME
+static const RNG90_HAL *rng90_request_hal;
+#endif
+
+static void rng90_request_select(const RNG90_Request *request)
+{
+	rng90_request_address = rng90_address;
+	rng90_address = request->address;
+	rng90_request_type = rng90_device_type;
+	rng90_device_type = request->type;
+#if RNG90_HAL_RUNTIME
+	rng90_request_hal = rng90_hal_current;
+	rng90_hal_current = request->hal;
+#endif
+}
+
+static void rng90_request_restore(void)
+{
+	rng90_address = rng90_request_address;
+	rng90_device_type = rng90_request_type;
+#if RNG90_HAL_RUNTIME
+	rng90_hal_current = rng90_request_hal;
+#endif
+}
+
+static unsigned long rng90_request_command(RNG90_Request *request)
+{
+	RNG90_Packet packet;
+	packet.count = 0;
+	packet.opcode = request->opcode;
+	packet.param1 = request->param1;
+	packet.param2 = 0x0000;
+	packet.crc = 0x0000;
+	
+	switch (request->opcode)
+	{
+		case RNG90_OPERATION_RANDOM:
+			request->status = rng90_random_command();
+			return rng90_timing_data[rng90_device_type].random_ms;
+		case RNG90_OPERATION_INFO:
+			packet.param1 = RNG90_OPERATION_INFO_PARAM1;
+			packet.param2 = RNG90_OPERATION_INFO_PARAM2;
+			rng90_command(&packet);
+			return rng90_timing_data[rng90_device_type].info_ms;
+		case RNG90_OPERATION_READ:
+			packet.param1 = RNG90_OPERATION_READ_PARAM1;
+			packet.param2 = RNG90_OPERATION_READ_PARAM2;
+			rng90_command(&packet);
+			return rng90_timing_data[rng90_device_type].read_ms;
+		case RNG90_OPERATION_SELF_TEST:
+			packet.param2 = RNG90_OPERATION_SELF_TEST_PARAM2;
+			rng90_command(&packet);
+			return rng90_timing_data[rng90_device_type].selftest_ms;
+		default:
+			request->status = RNG90_Status_Parse_Error;
+			return 0;
+	}
+}
+
+static RNG90_Status rng90_request_response(RNG90_Request *request)
+{
+	unsigned char length = RNG90_STANDARD_FRAME_SIZE;
+	unsigned char size = 0;
+	
+	switch (request->opcode)
+	{
+		case RNG90_OPERATION_RANDOM:
+			return rng90_random_response(request->data);
+		case RNG90_OPERATION_INFO:
+			length = RNG90_INFO_FRAME_SIZE;
+			size = sizeof(RNG90_Info);
+			break;
+		case RNG90_OPERATION_READ:
+			length = RNG90_SERIAL_FRAME_SIZE;
+			size = RNG90_OPERATION_READ_SERIAL_SIZE;
+			break;
+	}
+	
+	RNG90_Frame frame = rng90_data(rng90_buffer, sizeof(rng90_buffer));
+	
+	if(frame.status != RNG90_Data_Status_Valid)
+	{
+		return (request->opcode == RNG90_OPERATION_SELF_TEST) ? (RNG90_Status)RNG90_SelfTest_Error : RNG90_Status_Other_Error;
+	}
+	else if(frame.length == RNG90_STANDARD_FRAME_SIZE)
+	{
+		return (RNG90_Status)(rng90_buffer[0]);
+	}
+	else if(frame.length == length)
+	{
+		for (unsigned char i=0; i < size; i++)
+		{
+			*(request->data + i) = rng90_buffer[i];
+		}
+		return RNG90_Status_Success;
+	}
+	return RNG90_Status_Other_Error;
+}
+
+/**
+ * @brief Places a request descriptor into the submission queue of the driver.
+ *
+ * @param request Pointer to an ::RNG90_Request describing the command. The descriptor is copied, so it may be reused after the call.
+ *
+ * @return Returns `1` if the request was queued or `0` if the submission queue is full or the device type of the request is invalid.
+ *
+ * @details
+ * This function does not access the bus. The queued requests are executed in order by `rng90_service()`, each one on the device given by its address field, and the finished descriptors are handed back through `rng90_complete()`. Together these functions allow an application to keep several commands outstanding without blocking for the execution time of the RNG90 device.
+ *
+ * @warning The output buffer referenced by the request must remain valid until the request has completed. The blocking driver functions must not be used while requests are pending. This function has to be called from the same context as `rng90_service()` (e.g. the main loop), since the queues contain no memory barriers and accept only one producer.
+ */
+unsigned char rng90_submit(const RNG90_Request *request)
+{
+	unsigned char head = rng90_submission_head;
+	unsigned char next = (head + 1) & (RNG90_QUEUE_SIZE - 1);
+	
+	if((next == rng90_submission_tail) || (request->type >= RNG90_DEVICE_TYPES))
+	{
+		return 0;
+	}
+	rng90_submission[head] = *request;
+	rng90_submission[head].status = RNG90_Status_Success;
+	rng90_submission_head = next;
+	
+	RNG90_RECORD_REQUEST(request->opcode, (request->opcode == RNG90_OPERATION_RANDOM) ? RNG90_OPERATION_RANDOM_RNG_SIZE : 0);
+	
+	return 1;
+}
+
+/**
+ * @brief Advances the execution of queued requests without blocking.
+ *
+ * @details
+ * This function has to be called periodically every `RNG90_SERVICE_INTERVAL_MS`, e.g. from the main loop or a scheduler task. If no command is in progress, it sends the next queued request to its device. If a command is in progress, it counts down the execution time (or, if `RNG90_ACK_POLLING` is enabled, polls the device once the delay set by `RNG90_POLLING_DELAY_PERCENT` has passed) and, once the command has finished, reads and verifies the response. Requests with a callback are then passed to their callback, all other requests are moved into the completion queue. If the completion queue is full, the response stays in the device until a completed request has been fetched with `rng90_complete()`.
+ *
+ * @note Callbacks are invoked from within this function after the request has left the submission queue, so a callback may submit further requests.
+ *
+ * @warning This function must not be called from an interrupt service routine. It has to run in the same context as `rng90_submit()` and the `rng90_*_async()` functions, e.g. paced by a flag set in a timer interrupt (see README).
+ */
+void rng90_service(void)
+{
+	RNG90_Request *request = &rng90_submission[rng90_submission_tail];
+	
+	if(!rng90_request_active)
+	{
+		if(rng90_submission_tail == rng90_submission_head)
+		{
+			return;
+		}
+		rng90_request_select(request);
+		rng90_request_remaining_ms = rng90_request_command(request);
+		rng90_request_restore();
+#if RNG90_ACK_POLLING
+		rng90_request_polling_ms = rng90_request_remaining_ms - rng90_poll_delay(rng90_request_remaining_ms);
+#endif
+		rng90_request_active = 1;
+		
+		if(request->status == RNG90_Status_Success)
+		{
+			return;
+		}
+		rng90_request_remaining_ms = 0;
+	}
+	else if(rng90_request_remaining_ms > 0)
+	{
+		if(rng90_request_remaining_ms > RNG90_SERVICE_INTERVAL_MS)
+		{
+			rng90_request_remaining_ms -= RNG90_SERVICE_INTERVAL_MS;
+		}
+		else
+		{
+			rng90_request_remaining_ms = 0;
+		}
+		
+#if RNG90_ACK_POLLING
+		if(rng90_request_remaining_ms <= rng90_request_polling_ms)
+		{
+			rng90_request_select(request);
+			
+			if(rng90_ready())
+			{
+				rng90_request_remaining_ms = 0;
+			}
+			rng90_request_restore();
+		}
+#endif
+		if(rng90_request_remaining_ms > 0)
+		{
+			return;
+		}
+	}
+	
+	unsigned char next = (rng90_completion_head + 1) & (RNG90_QUEUE_SIZE - 1);
+	
+	if((request->callback == 0) && (next == rng90_completion_tail))
+	{
+		return;
+	}
+	
+	if(request->status == RNG90_Status_Success)
+	{
+		rng90_request_select(request);
+		request->status = rng90_request_response(request);
+		rng90_request_restore();
+	}
+	
+	RNG90_Request completed = *request;
+	
+	rng90_request_active = 0;
+	rng90_submission_tail = (rng90_submission_tail + 1) & (RNG90_QUEUE_SIZE - 1);
+	
+	if(completed.callback)
+	{
+		completed.callback(&completed);
+		return;
+	}
+	rng90_completion[rng90_completion_head] = completed;
+	rng90_completion_head = next;
+}
+
+/**
+ * @brief Fetches the next completed request from the completion queue.
+ *
+ * @param request Pointer to an ::RNG90_Request that receives the completed descriptor including its status and tag.
+ *
+ * @return Returns `1` if a completed request was copied to @p request or `0` if no request has completed.
+ *
+ * @details
+ * Requests complete in the order in which they were submitted. The status field of the descriptor contains the result of the command (see the corresponding blocking function); for self-test requests it holds the ::RNG90_SelfTest_Status reported by the device.
+ */
+unsigned char rng90_complete(RNG90_Request *request)
+{
+	unsigned char tail = rng90_completion_tail;
+	
+	if(tail == rng90_completion_head)
+	{
+		return 0;
+	}
+	*request = rng90_completion[tail];
+	rng90_completion_tail = (tail + 1) & (RNG90_QUEUE_SIZE - 1);
+	
+	return 1;
+}
+
+static unsigned char rng90_submit_callback(unsigned char opcode, unsigned char param1, unsigned char *data, RNG90_Callback callback, void *context)
+{
+	RNG90_Request request;
+	request.opcode = opcode;
+	request.param1 = param1;
+	request.address = rng90_address;
+	request.type = rng90_device_type;
+	request.tag = 0;
+	request.data = data;
+	request.callback = callback;
+	request.context = context;
+#if RNG90_HAL_RUNTIME
+	request.hal = rng90_hal_current;
+#endif
+	
+	return rng90_submit(&request);
+}
+
+/**
+ * @brief Requests random numbers from the RNG90 device without blocking.
+ *
+ * @param numbers Pointer to a buffer of at least `RNG90_OPERATION_RANDOM_RNG_SIZE` bytes that receives the random bytes.
+ * @param callback Function that is called from `rng90_service()` when the request has completed.
+ * @param context User pointer passed to @p callback in the context field of the request.
+ *
+ * @return Returns `1` if the request was queued or `0` if the submission queue is full.
+ *
+ * @details
+ * This function queues a random command for the currently selected device and returns immediately. When the response has been read and verified, @p callback receives the completed request; its status field holds the result as returned by `rng90_random()`.
+ */
+unsigned char rng90_random_async(unsigned char *numbers, RNG90_Callback callback, void *context)
+{
+	return rng90_submit_callback(RNG90_OPERATION_RANDOM, RNG90_OPERATION_RANDOM_PARAM1, numbers, callback, context);
+}
+
+/**
+ * @brief Requests device information from the RNG90 without blocking.
+ *
+ * @param info Pointer to an ::RNG90_Info structure that receives the device information.
+ * @param callback Function that is called from `rng90_service()` when the request has completed.
+ * @param context User pointer passed to @p callback in the context field of the request.
+ *
+ * @return Returns `1` if the request was queued or `0` if the submission queue is full.
+ *
+ * @details
+ * This function queues an info command for the currently selected device and returns immediately. The status field of the completed request holds the result as returned by `rng90_info()`.
+ */
+unsigned char rng90_info_async(RNG90_Info *info, RNG90_Callback callback, void *context)
+{
+	return rng90_submit_callback(RNG90_OPERATION_INFO, RNG90_OPERATION_INFO_PARAM1, (unsigned char *)info, callback, context);
+}
+
+/**
+ * @brief Reads the device serial number from the RNG90 without blocking.
+ *
+ * @param serial Pointer to a buffer of at least `RNG90_OPERATION_READ_SERIAL_SIZE` bytes that receives the serial number.
+ * @param callback Function that is called from `rng90_service()` when the request has completed.
+ * @param context User pointer passed to @p callback in the context field of the request.
+ *
+ * @return Returns `1` if the request was queued or `0` if the submission queue is full.
+ *
+ * @details
+ * This function queues a read command for the currently selected device and returns immediately. The status field of the completed request holds the result as returned by `rng90_serial()`.
+ */
+unsigned char rng90_serial_async(unsigned char *serial, RNG90_Callback callback, void *context)
+{
+	return rng90_submit_callback(RNG90_OPERATION_READ, RNG90_OPERATION_READ_PARAM1, serial, callback, context);
+}
+
+/**
+ * @brief Executes a self-test routine on the RNG90 device without blocking.
+ *
+ * @param test Specifies which self-test to run, using a value from ::RNG90_Run_SelfTest.
+ * @param callback Function that is called from `rng90_service()` when the request has completed.
+ * @param context User pointer passed to @p callback in the context field of the request.
+ *
+ * @return Returns `1` if the request was queued or `0` if the submission queue is full.
+ *
+ * @details
+ * This function queues a self-test command for the currently selected device and returns immediately. The status field of the completed request holds the ::RNG90_SelfTest_Status as returned by `rng90_selftest()`.
+ */
+unsigned char rng90_selftest_async(RNG90_Run_SelfTest test, RNG90_Callback callback, void *context)
+{
+	return rng90_submit_callback(RNG90_OPERATION_SELF_TEST, test, 0, callback, context);
 }
\ No newline at end of file
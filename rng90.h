@@ -40,7 +40,7 @@
 		 * @brief Defines the TWI/I2C address of the RNG90 device.
 		 *
 		 * @details
-		 * This macro specifies the 7-bit I2C slave address used to communicate with the RNG90 device on the TWI/I2C bus. The value can be overridden by defining `RNG90_ADDRESS` before including this header if the hardware configuration uses a different address.
+		 * This macro specifies the 7-bit I2C slave address used to communicate with the RNG90 device on the TWI/I2C bus. The value can be overridden by defining `RNG90_ADDRESS` before including this header if the hardware configuration uses a different address. It is the address selected at startup; further devices can be addressed at runtime with `rng90_select()`.
 		 *
 		 * @note By default, `RNG90_ADDRESS` is set to `0x40`.
 		 */
@@ -651,6 +651,162 @@
 		#define RNG90_WDT_RESET_TIME_MS 1300UL
 	#endif
 	
+	#ifndef RNG90_ATECC608_OPERATION_RANDOM
+		/**
+		 * @def RNG90_ATECC608_OPERATION_RANDOM
+		 * @brief Defines the operation code of the random command sent to an ATECC608 device.
+		 *
+		 * @details
+		 * On the ATECC508/608 the opcode `0x16` used by the RNG90 selects the Nonce command, the random command uses its own opcode. The value is used when the device type `RNG90_Device_ATECC608` is selected with `rng90_select_type()`.
+		 *
+		 * @note By default, `RNG90_ATECC608_OPERATION_RANDOM` is set to `0x1B`.
+		 */
+		#define RNG90_ATECC608_OPERATION_RANDOM 0x1B
+	#endif
+	
+	#ifndef RNG90_ATECC608_OPERATION_RANDOM_DATA_SIZE
+		/**
+		 * @def RNG90_ATECC608_OPERATION_RANDOM_DATA_SIZE
+		 * @brief Defines the size of the data field of a random command sent to an ATECC608 device.
+		 *
+		 * @details
+		 * In contrast to the RNG90, the random command of the ATECC608 carries no data field. The value is used when the device type `RNG90_Device_ATECC608` is selected with `rng90_select_type()`.
+		 *
+		 * @note By default, `RNG90_ATECC608_OPERATION_RANDOM_DATA_SIZE` is set to `0UL`.
+		 */
+		#define RNG90_ATECC608_OPERATION_RANDOM_DATA_SIZE 0UL
+	#endif
+	
+	#ifndef RNG90_ATECC608_INFO_EXECUTION_TIME_MS
+		/**
+		 * @def RNG90_ATECC608_INFO_EXECUTION_TIME_MS
+		 * @brief Defines the execution time for info commands of an ATECC608 device in milliseconds.
+		 *
+		 * @details
+		 * This macro specifies the time, in milliseconds, the driver waits for an info command if the device type `RNG90_Device_ATECC608` is selected.
+		 *
+		 * @note By default, `RNG90_ATECC608_INFO_EXECUTION_TIME_MS` is set to `1UL`.
+		 */
+		#define RNG90_ATECC608_INFO_EXECUTION_TIME_MS 1UL
+	#endif
+	
+	#ifndef RNG90_ATECC608_RANDOM_EXECUTION_TIME_MS
+		/**
+		 * @def RNG90_ATECC608_RANDOM_EXECUTION_TIME_MS
+		 * @brief Defines the execution time for random commands of an ATECC608 device in milliseconds.
+		 *
+		 * @details
+		 * This macro specifies the time, in milliseconds, the driver waits for a random command if the device type `RNG90_Device_ATECC608` is selected.
+		 *
+		 * @note By default, `RNG90_ATECC608_RANDOM_EXECUTION_TIME_MS` is set to `23UL`.
+		 */
+		#define RNG90_ATECC608_RANDOM_EXECUTION_TIME_MS 23UL
+	#endif
+	
+	#ifndef RNG90_ATECC608_READ_EXECUTION_TIME_MS
+		/**
+		 * @def RNG90_ATECC608_READ_EXECUTION_TIME_MS
+		 * @brief Defines the execution time for read commands of an ATECC608 device in milliseconds.
+		 *
+		 * @details
+		 * This macro specifies the time, in milliseconds, the driver waits for a read command if the device type `RNG90_Device_ATECC608` is selected.
+		 *
+		 * @note By default, `RNG90_ATECC608_READ_EXECUTION_TIME_MS` is set to `1UL`.
+		 */
+		#define RNG90_ATECC608_READ_EXECUTION_TIME_MS 1UL
+	#endif
+	
+	#ifndef RNG90_ATECC608_SELFTEST_EXECUTION_TIME_MS
+		/**
+		 * @def RNG90_ATECC608_SELFTEST_EXECUTION_TIME_MS
+		 * @brief Defines the execution time for self-test commands of an ATECC608 device in milliseconds.
+		 *
+		 * @details
+		 * This macro specifies the time, in milliseconds, the driver waits for a self-test command if the device type `RNG90_Device_ATECC608` is selected.
+		 *
+		 * @note By default, `RNG90_ATECC608_SELFTEST_EXECUTION_TIME_MS` is set to `250UL`.
+		 */
+		#define RNG90_ATECC608_SELFTEST_EXECUTION_TIME_MS 250UL
+	#endif
+	
+	#ifndef RNG90_ACK_POLLING
+		/**
+		 * @def RNG90_ACK_POLLING
+		 * @brief Enables acknowledge polling instead of fixed execution delays.
+		 *
+		 * @details
+		 * If this macro is set to `1`, the driver does not wait the full execution time of a command. Instead it sleeps for `RNG90_POLLING_DELAY_PERCENT` of the execution time, then addresses the RNG90 device every `RNG90_POLLING_INTERVAL_MS` and continues as soon as the device acknowledges its address, which it does not while a command is still executing. The execution times are then only used as upper limit. This reduces the latency of every command to the actual execution time of the device, at the cost of some additional bus traffic while waiting. The TWI/I2C library must report a missing acknowledge through the return value of `twi_address()`.
+		 *
+		 * @note By default, `RNG90_ACK_POLLING` is set to `0` (disabled).
+		 */
+		#define RNG90_ACK_POLLING 0
+	#endif
+	
+	#ifndef RNG90_REPEAT_DETECTION_BLOCKS
+		/**
+		 * @def RNG90_REPEAT_DETECTION_BLOCKS
+		 * @brief Defines the number of recent random blocks checked for repetitions.
+		 *
+		 * @details
+		 * If this macro is greater than zero, the driver keeps a 32-bit fingerprint of the last `RNG90_REPEAT_DETECTION_BLOCKS` random blocks and rejects a block whose fingerprint matches one of them with `RNG90_Status_HealthTest_Error` (see `rng90_repeat_check()`). This detects a faulty or tampered device replaying earlier output. Every entry needs four bytes of RAM.
+		 *
+		 * @note By default, `RNG90_REPEAT_DETECTION_BLOCKS` is set to `0` (disabled). The value must not exceed `65535`.
+		 */
+		#define RNG90_REPEAT_DETECTION_BLOCKS 0
+	#endif
+	
+	#ifndef RNG90_RECORD_REQUEST
+		/**
+		 * @def RNG90_RECORD_REQUEST
+		 * @brief Hook called by the driver for every request made by the application.
+		 *
+		 * @details
+		 * This function-like macro is expanded at the entry of every public request function with the opcode of the command (`RNG90_OPERATION_RANDOM`, `RNG90_OPERATION_INFO`, `RNG90_OPERATION_READ` or `RNG90_OPERATION_SELF_TEST`) and the number of requested random bytes (`0` for other commands). Define it (together with a declaration of the function it calls) before including this header to record the workload of an application, e.g. by storing a systick timestamp, the opcode and the length in a RAM ring buffer that is read out later and replayed against a test setup. The hook should be short, since it runs on the request path.
+		 *
+		 * @note By default, `RNG90_RECORD_REQUEST` expands to nothing, so recording has no overhead.
+		 */
+		#define RNG90_RECORD_REQUEST(opcode, length)
+	#endif
+	
+	#ifndef RNG90_HAL_RUNTIME
+		/**
+		 * @def RNG90_HAL_RUNTIME
+		 * @brief Enables runtime selection of the TWI/I2C operations used by the driver.
+		 *
+		 * @details
+		 * If this macro is set to `0`, the driver calls the `twi_*` functions of the HAL selected by `RNG90_HAL_PLATFORM` directly, without any overhead. If it is set to `1`, all bus accesses are performed through the ::RNG90_HAL operations table selected with `rng90_hal()`, so several bus implementations (e.g. two TWI peripherals, a bit-banged bus or a simulator) can be used by one firmware image.
+		 *
+		 * @note By default, `RNG90_HAL_RUNTIME` is set to `0` (compile-time HAL).
+		 */
+		#define RNG90_HAL_RUNTIME 0
+	#endif
+	
+	#ifndef RNG90_POLLING_INTERVAL_MS
+		/**
+		 * @def RNG90_POLLING_INTERVAL_MS
+		 * @brief Defines the interval between two acknowledge polls in milliseconds.
+		 *
+		 * @details
+		 * This macro specifies the time, in milliseconds, between two attempts to address a busy RNG90 device when `RNG90_ACK_POLLING` is enabled. Smaller values reduce the latency after command completion, larger values reduce bus traffic while the device is busy.
+		 *
+		 * @note By default, `RNG90_POLLING_INTERVAL_MS` is set to `1UL`.
+		 */
+		#define RNG90_POLLING_INTERVAL_MS 1UL
+	#endif
+	
+	#ifndef RNG90_POLLING_DELAY_PERCENT
+		/**
+		 * @def RNG90_POLLING_DELAY_PERCENT
+		 * @brief Defines the share of the execution time that passes before acknowledge polling starts.
+		 *
+		 * @details
+		 * This macro specifies, in percent of the execution time of each command (see ::RNG90_Timing), how long the driver sleeps after sending a command before it starts to poll the device when `RNG90_ACK_POLLING` is enabled. The value should be set so that the delay ends shortly before the typical completion of the device. Polls are then limited to the spread of the actual execution time instead of occupying a shared bus for the whole command. `0` starts polling immediately, `100` disables polling in effect.
+		 *
+		 * @note By default, `RNG90_POLLING_DELAY_PERCENT` is set to `50UL`.
+		 */
+		#define RNG90_POLLING_DELAY_PERCENT 50UL
+	#endif
+	
     #ifndef RNG90_CRC_POLYNOMIAL
 		/**
 		 * @def RNG90_CRC_POLYNOMIAL
@@ -729,6 +885,71 @@
 		#define RNG90_SERIAL_FRAME_SIZE 19UL
     #endif
 
+    #ifndef RNG90_BUFFER_SIZE
+		/**
+		 * @def RNG90_BUFFER_SIZE
+		 * @brief Defines the size of the internal receive buffer of the RNG90 driver.
+		 *
+		 * @details
+		 * This macro specifies the number of payload bytes the driver can buffer internally while parsing a response frame. It is derived from the largest response used by the driver (`RNG90_NUMBER_FRAME_SIZE` without count byte and CRC). Random data is read directly into the caller buffer wherever possible and cleared from the internal buffer after use, so no random material remains in driver memory.
+		 *
+		 * @note By default, `RNG90_BUFFER_SIZE` is set to `(RNG90_NUMBER_FRAME_SIZE - 1UL - RNG90_CRC_SIZE)`. Values smaller than `RNG90_OPERATION_RANDOM_RNG_SIZE` or larger than `255` are rejected at compile time.
+		 */
+		#define RNG90_BUFFER_SIZE (RNG90_NUMBER_FRAME_SIZE - 1UL - RNG90_CRC_SIZE)
+    #endif
+
+    #ifndef RNG90_UUID_SIZE
+		/**
+		 * @def RNG90_UUID_SIZE
+		 * @brief Defines the size of a binary UUID returned by `rng90_random_uuid()`.
+		 *
+		 * @details
+		 * This macro specifies the number of bytes of a universally unique identifier (RFC 4122) in binary form. It is used by the application to allocate buffers for `rng90_random_uuid()`.
+		 *
+		 * @note By default, `RNG90_UUID_SIZE` is set to `16U`.
+		 */
+		#define RNG90_UUID_SIZE 16U
+    #endif
+
+    #ifndef RNG90_FEED_BATCH_BLOCKS
+		/**
+		 * @def RNG90_FEED_BATCH_BLOCKS
+		 * @brief Defines the maximum number of random blocks fetched by a single call to `rng90_feed()`.
+		 *
+		 * @details
+		 * This macro limits how many `RNG90_OPERATION_RANDOM_RNG_SIZE` byte blocks are requested from the RNG90 device and passed to a sink in one feeding cycle. The actual number of blocks is the smaller value of this limit and the demand reported by the sink, so the bus stays idle while the sink is full.
+		 *
+		 * @note By default, `RNG90_FEED_BATCH_BLOCKS` is set to `4U`.
+		 */
+		#define RNG90_FEED_BATCH_BLOCKS 4U
+    #endif
+
+    #ifndef RNG90_QUEUE_SIZE
+		/**
+		 * @def RNG90_QUEUE_SIZE
+		 * @brief Defines the number of entries in the request submission and completion queues.
+		 *
+		 * @details
+		 * This macro specifies the size of the ring buffers used by `rng90_submit()`, `rng90_service()` and `rng90_complete()`. The value has to be a power of two between `2` and `256`, other values are rejected at compile time; one entry of each ring is kept free to distinguish a full from an empty queue.
+		 *
+		 * @note By default, `RNG90_QUEUE_SIZE` is set to `4U`.
+		 */
+		#define RNG90_QUEUE_SIZE 4U
+    #endif
+	
+    #ifndef RNG90_SERVICE_INTERVAL_MS
+		/**
+		 * @def RNG90_SERVICE_INTERVAL_MS
+		 * @brief Defines the interval in milliseconds in which `rng90_service()` is called by the application.
+		 *
+		 * @details
+		 * This macro specifies the time base used by `rng90_service()` to count down the execution time of a queued command. It has to match the period in which the application calls the service routine.
+		 *
+		 * @note By default, `RNG90_SERVICE_INTERVAL_MS` is set to `1UL`.
+		 */
+		#define RNG90_SERVICE_INTERVAL_MS 1UL
+    #endif
+
 	#include "../../../utils/macros/stringify.h"
 
 	#include _STR(../../../hal/RNG90_HAL_PLATFORM/twi/twi.h)
@@ -810,6 +1031,26 @@
      */
     typedef enum RNG90_SelfTest_Status_t RNG90_SelfTest_Status;
 	
+	/**
+     * @enum RNG90_Device_Type_t
+     * @brief Selects the type of CryptoAuthentication device addressed by the driver.
+     *
+     * @details
+     * This enumeration defines the device types that share the command framing of the RNG90 and can therefore be used as random number source by this driver. The type determines the layout of the random command and the execution times.
+     */
+    enum RNG90_Device_Type_t
+    {
+        RNG90_Device_RNG90    = 0, /**< RNG90 random number generator */
+        RNG90_Device_ATECC608,     /**< ATECC608 CryptoAuthentication device */
+        RNG90_DEVICE_TYPES         /**< Number of supported device types */
+    };
+
+    /**
+     * @typedef RNG90_Device_Type
+     * @brief Alias for enum RNG90_Device_Type_t representing a CryptoAuthentication device type.
+     */
+    typedef enum RNG90_Device_Type_t RNG90_Device_Type;
+	
 	/**
      * @struct RNG90_Info_t
      * @brief Holds basic identification and revision information for the RNG90 device.
@@ -890,11 +1131,182 @@
      * @brief Alias for struct RNG90_Frame_t representing an RNG90 data frame.
      */
     typedef struct RNG90_Frame_t RNG90_Frame;
+
+	/**
+     * @struct RNG90_Sink_t
+     * @brief Describes a consumer of random blocks used by `rng90_feed()`.
+     *
+     * @details
+     * This structure connects the RNG90 driver with an entropy consumer such as an operating system entropy pool, a software DRBG or a file used for testing. The demand callback reports how many blocks of `RNG90_OPERATION_RANDOM_RNG_SIZE` bytes the consumer can currently accept (e.g. derived from an entropy watermark), the write callback receives each block read from the device.
+     */
+    struct RNG90_Sink_t
+    {
+        unsigned char (*demand)(void);                        /**< Returns the number of random blocks the sink can currently accept */
+        void          (*write)(const unsigned char *numbers); /**< Consumes one block of `RNG90_OPERATION_RANDOM_RNG_SIZE` random bytes */
+    };
+
+    /**
+     * @typedef RNG90_Sink
+     * @brief Alias for struct RNG90_Sink_t representing a random block consumer.
+     */
+    typedef struct RNG90_Sink_t RNG90_Sink;
+
+	/**
+     * @struct RNG90_Statistics_t
+     * @brief Holds operating counters of the RNG90 driver.
+     *
+     * @details
+     * This structure contains counters that are updated by the driver while communicating with the RNG90 device. They allow monitoring the throughput and the error rate of a device, e.g. from a diagnostic command line or a status page.
+     */
+    struct RNG90_Statistics_t
+    {
+        unsigned long frames;        /**< Number of response frames read from the device */
+        unsigned long random_blocks; /**< Number of random blocks of `RNG90_OPERATION_RANDOM_RNG_SIZE` bytes delivered to the application */
+        unsigned long crc_errors;    /**< Number of response frames with an invalid CRC */
+        unsigned long status_frames; /**< Number of status frames reporting a device error */
+        unsigned long twi_errors;    /**< Number of TWI/I2C errors while sending a command */
+        unsigned long polls;         /**< Number of polls after the initial delay the device did not answer because it was still busy (see `RNG90_ACK_POLLING` and `RNG90_POLLING_DELAY_PERCENT`) */
+    };
+
+    /**
+     * @typedef RNG90_Statistics
+     * @brief Alias for struct RNG90_Statistics_t representing RNG90 driver counters.
+     */
+    typedef struct RNG90_Statistics_t RNG90_Statistics;
+
+	/**
+     * @struct RNG90_Timing_t
+     * @brief Holds the command execution times used by the RNG90 driver.
+     *
+     * @details
+     * This structure contains the time, in milliseconds, the driver waits for each command type before reading the response. The driver keeps one set of values per device type; they are initialized from the `RNG90_*_EXECUTION_TIME_MS` macros and can be changed at runtime with `rng90_timing_set()`.
+     */
+    struct RNG90_Timing_t
+    {
+        unsigned long info_ms;     /**< Execution time of the info command */
+        unsigned long random_ms;   /**< Execution time of the random command */
+        unsigned long read_ms;     /**< Execution time of the read (serial number) command */
+        unsigned long selftest_ms; /**< Execution time of the self-test command */
+    };
+
+    /**
+     * @typedef RNG90_Timing
+     * @brief Alias for struct RNG90_Timing_t representing RNG90 command execution times.
+     */
+    typedef struct RNG90_Timing_t RNG90_Timing;
+
+#if RNG90_REPEAT_DETECTION_BLOCKS
+	/**
+     * @struct RNG90_Repeat_t
+     * @brief Holds the fingerprint history used by `rng90_repeat_check()`.
+     *
+     * @details
+     * This structure contains a ring of the fingerprints of the last `RNG90_REPEAT_DETECTION_BLOCKS` random blocks. The driver keeps its own history for the blocks it receives; the application can create further zero-initialized histories, e.g. to check captured random data.
+     */
+    struct RNG90_Repeat_t
+    {
+        unsigned long fingerprints[RNG90_REPEAT_DETECTION_BLOCKS]; /**< Fingerprints of the previous blocks */
+        unsigned int  index;                                       /**< Position of the next fingerprint in the ring */
+        unsigned int  count;                                       /**< Number of valid fingerprints in the ring */
+    };
+
+    /**
+     * @typedef RNG90_Repeat
+     * @brief Alias for struct RNG90_Repeat_t representing a repeated-block history.
+     */
+    typedef struct RNG90_Repeat_t RNG90_Repeat;
+#endif
+
+	/**
+     * @struct RNG90_HAL_t
+     * @brief Holds the TWI/I2C operations used by the driver if `RNG90_HAL_RUNTIME` is enabled.
+     *
+     * @details
+     * This structure mirrors the functions of the [twi.h](https://0x007e.github.io/drivers-crypto-rng90/twi_8h.html)-header and uses the same types (see `TWI_enums.h`), so the platform functions can be placed into a table directly, e.g. `{ twi_start, twi_address, twi_set, twi_get, twi_stop }`. Every bus implementation provides its own table, the driver uses the table selected with `rng90_hal()`. The address, set and get operations return `TWI_None` on success.
+     */
+    struct RNG90_HAL_t
+    {
+        void      (*start)(void);                                            /**< Generates a start condition on the bus */
+        TWI_Error (*address)(unsigned char address, TWI_Operation operation); /**< Addresses a device for `TWI_Write` or `TWI_Read` */
+        TWI_Error (*set)(unsigned char data);                                /**< Writes one byte to the bus */
+        TWI_Error (*get)(unsigned char *data, TWI_Acknowledge acknowledge);  /**< Reads one byte and answers with `TWI_ACK` or `TWI_NACK` */
+        void      (*stop)(void);                                             /**< Generates a stop condition on the bus */
+    };
+
+    /**
+     * @typedef RNG90_HAL
+     * @brief Alias for struct RNG90_HAL_t representing a TWI/I2C operations table.
+     */
+    typedef struct RNG90_HAL_t RNG90_HAL;
+
+	/**
+     * @struct RNG90_Request_t
+     * @brief Describes a command queued for non-blocking execution on an RNG90 device.
+     *
+     * @details
+     * This structure is used as submission and completion descriptor by `rng90_submit()`, `rng90_service()` and `rng90_complete()`. The opcode selects the command (`RNG90_OPERATION_RANDOM`, `RNG90_OPERATION_INFO`, `RNG90_OPERATION_READ` or `RNG90_OPERATION_SELF_TEST`), the output buffer receives the payload (`RNG90_OPERATION_RANDOM_RNG_SIZE` random bytes, an ::RNG90_Info structure or `RNG90_OPERATION_READ_SERIAL_SIZE` serial bytes) and the tag is returned unchanged so the application can match completions to its requests. If a callback is set, the completed request is passed to it instead of the completion queue, which allows event-driven applications to use the RNG90 without polling.
+     *
+     * @note All fields except status have to be filled before the request is passed to `rng90_submit()`, including the device type (see `rng90_select_type()`) and, if `RNG90_HAL_RUNTIME` is enabled, the bus operations table. Requests with an invalid device type are rejected.
+     */
+    struct RNG90_Request_t
+    {
+        unsigned char  opcode;  /**< Operation code of the command to execute */
+        unsigned char  param1;  /**< Self-test selection (::RNG90_Run_SelfTest) for self-test requests, ignored otherwise */
+        unsigned char  address; /**< TWI/I2C address of the RNG90 device that executes the request */
+        unsigned char  tag;     /**< User defined tag returned with the completed request */
+        unsigned char *data;    /**< Output buffer for the response payload (unused for self-test requests) */
+        RNG90_Status   status;  /**< Result of the request, valid after completion */
+        void         (*callback)(const struct RNG90_Request_t *request); /**< Function called on completion, or `0` to deliver the request through `rng90_complete()` */
+        void          *context; /**< User pointer available to the callback */
+        RNG90_Device_Type type; /**< Type of the device that executes the request (see `rng90_select_type()`) */
+#if RNG90_HAL_RUNTIME
+        const RNG90_HAL *hal;   /**< TWI/I2C operations of the bus the device is connected to */
+#endif
+    };
+
+    /**
+     * @typedef RNG90_Request
+     * @brief Alias for struct RNG90_Request_t representing a queued RNG90 request.
+     */
+    typedef struct RNG90_Request_t RNG90_Request;
+	
+    /**
+     * @typedef RNG90_Callback
+     * @brief Function type called by `rng90_service()` when an asynchronous request has completed.
+     */
+    typedef void (*RNG90_Callback)(const RNG90_Request *request);
 	
     RNG90_Status rng90_init(void);
+    void rng90_select(unsigned char address);
+    void rng90_select_type(RNG90_Device_Type type);
+#if RNG90_HAL_RUNTIME
+    void rng90_hal(const RNG90_HAL *hal);
+#endif
+    void rng90_timing_set(const RNG90_Timing *timing);
+    void rng90_timing_get(RNG90_Timing *timing);
     RNG90_SelfTest_Status rng90_selftest(RNG90_Run_SelfTest test);
     RNG90_Status rng90_info(RNG90_Info *info);
     RNG90_Status rng90_random(unsigned char *numbers);
+    RNG90_Status rng90_random_devices(const unsigned char *addresses, unsigned char count, unsigned char *numbers);
+    RNG90_Status rng90_stream(unsigned char *buffer, unsigned int length);
+    RNG90_Status rng90_random_bytes(unsigned char *buffer, unsigned char length);
+    void rng90_discard(void);
+#if RNG90_REPEAT_DETECTION_BLOCKS
+    unsigned char rng90_repeat_check(RNG90_Repeat *repeat, const unsigned char *numbers);
+#endif
+    RNG90_Status rng90_random_u32(unsigned long *value);
+    RNG90_Status rng90_random_range(unsigned long bound, unsigned long *value);
+    RNG90_Status rng90_random_uuid(unsigned char *uuid);
     RNG90_Status rng90_serial(unsigned char *serial);
+    RNG90_Status rng90_feed(const RNG90_Sink *sink);
+    void rng90_statistics(RNG90_Statistics *statistics);
+    void rng90_statistics_reset(void);
+    unsigned char rng90_submit(const RNG90_Request *request);
+    void rng90_service(void);
+    unsigned char rng90_complete(RNG90_Request *request);
+    unsigned char rng90_random_async(unsigned char *numbers, RNG90_Callback callback, void *context);
+    unsigned char rng90_info_async(RNG90_Info *info, RNG90_Callback callback, void *context);
+    unsigned char rng90_serial_async(unsigned char *serial, RNG90_Callback callback, void *context);
+    unsigned char rng90_selftest_async(RNG90_Run_SelfTest test, RNG90_Callback callback, void *context);
 
 #endif /* RNG90_H_ */
\ No newline at end of file